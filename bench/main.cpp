@@ -0,0 +1,82 @@
+import std;
+import eco;
+
+// Compares single and batched rank_1 and select_1 on a random bitvector of
+// 2^k bits, where k is the first argument (31 by default), using 2^22 random
+// queries. The batched answers are checked against the single ones.
+
+namespace {
+
+using bitvector = eco::basic_bitvector<std::uint64_t>;
+using ssize_type = bitvector::ssize_type;
+
+template <typename F>
+auto
+seconds(F f) -> double
+{
+  auto const start{std::chrono::steady_clock::now()};
+  f();
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void
+report(char const* name, double single, double batched)
+{
+  std::println("{:8} single {:7.3f} s  batched {:7.3f} s  speedup {:4.2f}x", name, single, batched, single / batched);
+}
+
+} // namespace
+
+auto
+main(int argc, char** argv) -> int
+{
+  auto const k{argc > 1 ? std::atoi(argv[1]) : 31};
+  if (k < 12 || k > 40) {
+    std::println(std::cerr, "usage: bench [log2 of the size, 12 to 40]");
+    return 1;
+  }
+
+  auto const n{ssize_type{1} << k};
+  std::mt19937_64 gen{42};
+  std::vector<std::uint64_t> words(static_cast<std::size_t>(n / 64));
+  for (auto& x : words) {
+    x = gen();
+  }
+  bitvector b{words, n};
+  words = {};
+
+  std::vector<ssize_type> queries(std::size_t{1} << 22);
+  std::vector<ssize_type> out(queries.size());
+  ssize_type checksum{};
+
+  for (auto& x : queries) {
+    x = static_cast<ssize_type>(gen() % static_cast<std::uint64_t>(n + 1));
+  }
+  auto const rank_single{seconds([&] {
+    for (auto const x : queries) {
+      checksum += b.rank_1(x);
+    }
+  })};
+  auto const rank_batched{seconds([&] {
+    b.rank_1(queries, out);
+  })};
+  checksum -= std::accumulate(out.begin(), out.end(), ssize_type{});
+  report("rank_1", rank_single, rank_batched);
+
+  auto const ones{b.rank_1(n)};
+  for (auto& x : queries) {
+    x = static_cast<ssize_type>(gen() % static_cast<std::uint64_t>(ones));
+  }
+  auto const select_single{seconds([&] {
+    for (auto const x : queries) {
+      checksum += b.select_1(x);
+    }
+  })};
+  auto const select_batched{seconds([&] {
+    b.select_1(queries, out);
+  })};
+  checksum -= std::accumulate(out.begin(), out.end(), ssize_type{});
+  report("select_1", select_single, select_batched);
+
+  return checksum == 0 ? 0 : 1;
+}
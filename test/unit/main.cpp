@@ -115,6 +115,57 @@ set_right_successor(ptree_cursor i, ptree_cursor j)
   i.value->next_sibling = j.value;
 }
 
+// Bits of the shared bitvector fixture: bit i is set when i * 7919 % modulus is
+// less than below, and in a run of 599 1-bits after position 70000.
+inline auto
+fixture_bits(std::ptrdiff_t n, std::ptrdiff_t modulus, std::ptrdiff_t below) -> std::vector<char>
+{
+  std::vector<char> ret(static_cast<std::size_t>(n));
+  for (std::ptrdiff_t i = 0; i != n; ++i) {
+    ret[i] = (i * 7919) % modulus < below || (70000 < i && i < 70600);
+  }
+  return ret;
+}
+
+// Returns a bitvector of type B holding bits, which has not been initialized.
+template <typename B>
+inline auto
+make_bitvector(std::vector<char> const& bits) -> B
+{
+  B ret{static_cast<std::ptrdiff_t>(bits.size())};
+  for (std::ptrdiff_t i = 0; i != std::ssize(bits); ++i) {
+    if (bits[i]) ret.bit_set(i);
+  }
+  return ret;
+}
+
+// Checks bit_read, rank and select of x at every position against bits.
+template <typename B>
+inline void
+check_bitvector(B const& x, std::vector<char> const& bits)
+{
+  assert(x.size() == std::ssize(bits));
+
+  std::ptrdiff_t ones = 0;
+  std::ptrdiff_t zeros = 0;
+  for (std::ptrdiff_t i = 0; i != std::ssize(bits); ++i) {
+    assert(x.bit_read(i) == bool(bits[i]));
+    assert(x.rank_1(i) == ones);
+    assert(x.rank_0(i) == zeros);
+    if (bits[i]) {
+      assert(x.select_1(ones) == i);
+      ++ones;
+    } else {
+      assert(x.select_0(zeros) == i);
+      ++zeros;
+    }
+  }
+  assert(x.rank_1(x.size()) == ones);
+  assert(x.rank_0(x.size()) == zeros);
+  assert(x.select_1(ones) == x.size());
+  assert(x.select_0(zeros) == x.size());
+}
+
 #include "test_bit.hpp"
 #include "test_memory.hpp"
 #include "test_allocator.hpp"
@@ -127,6 +178,8 @@ set_right_successor(ptree_cursor i, ptree_cursor j)
 #include "test_codec.hpp"
 #include "test_tape.hpp"
 #include "test_bitvector.hpp"
+#include "test_compressed_bitvector.hpp"
+#include "test_dynamic_bitvector.hpp"
 #include "test_parentheses.hpp"
 #include "test_binary_tree.hpp"
 #include "test_ordinal_tree.hpp"
@@ -162,6 +215,10 @@ int main()
   test_gamma_codec();
   test_tape();
   test_basic_bitvector();
+  test_interleaved_bitvector();
+  test_rrr_bitvector();
+  test_elias_fano();
+  test_dynamic_bitvector();
   test_basic_parentheses();
   test_balanced_binary_tree();
   test_binary_louds();
@@ -71,6 +71,34 @@ test_malloc_allocator()
   }
 }
 
+void
+test_aligned_allocator()
+{
+  {
+    eco::aligned_allocator<64> x;
+    auto memory{x.allocate(1)};
+    assert(memory.first != nullptr);
+    assert(memory.size == 1);
+    assert(std::bit_cast<std::uintptr_t>(memory.first) % 64 == 0);
+    assert(x.deallocate(memory));
+  }
+  {
+    eco::aligned_allocator<4096> x;
+    auto memory{x.allocate(100)};
+    assert(memory.first != nullptr);
+    assert(memory.size == 100);
+    assert(std::bit_cast<std::uintptr_t>(memory.first) % 4096 == 0);
+    assert(x.deallocate(memory));
+  }
+  {
+    eco::aligned_allocator<64> x;
+    auto memory{x.allocate(0)};
+    assert(memory.first == nullptr);
+    assert(memory.size == 0);
+    assert(x.deallocate(memory));
+  }
+}
+
 template <eco::deallocatable_allocator A>
 inline void
 test_arena_allocator()
@@ -139,6 +167,7 @@ void
 test_allocator()
 {
   test_malloc_allocator();
+  test_aligned_allocator();
   test_arena_allocator<eco::malloc_allocator>();
 }
 
@@ -337,6 +337,23 @@ test_bit()
     assert(eco::select_0(x, 3) == 5);
     assert(eco::select_0(x, 4) == 7);
   }
+
+  {
+    static_assert(eco::select_1(std::uint64_t{0b01011001}, 4) == 6);
+    static_assert(eco::select_1(std::uint64_t{1} << 63, 1) == 63);
+    static_assert(eco::select_0(std::uint64_t{0}, 64) == 63);
+
+    std::uint64_t x{0x8000'0100'0020'0001};
+    assert(eco::select_1(x, 1) == 0);
+    assert(eco::select_1(x, 2) == 21);
+    assert(eco::select_1(x, 3) == 40);
+    assert(eco::select_1(x, 4) == 63);
+    assert(eco::select_1(~std::uint64_t{0}, 33) == 32);
+    assert(eco::select_0(x, 1) == 1);
+    assert(eco::select_0(x, 20) == 20);
+    assert(eco::select_0(x, 21) == 22);
+    assert(eco::select_0(x, 60) == 62);
+  }
 }
 
 #endif
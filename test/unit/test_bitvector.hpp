@@ -131,6 +131,364 @@ test_basic_bitvector()
     assert(x.select_1(2) == 55);
     assert(x.select_1(3) == 55);
   }
+
+  {
+    // Bitvectors of different sizes differ even when their words are equal.
+    eco::basic_bitvector x{60};
+    eco::basic_bitvector y{64};
+    x.bit_set(5);
+    y.bit_set(5);
+    assert(x != y);
+    assert(x < y);
+    y.bit_clear(5);
+    assert(x < y);
+  }
+
+  {
+    auto const bits = fixture_bits(140000, 13, 4);
+    auto const x = make_bitvector<eco::basic_bitvector<>>(bits);
+    auto y{x};
+    y.init();
+    assert(x == y);
+    assert(!(x < y));
+    check_bitvector(y, bits);
+
+    // Without init, select scans the words.
+    for (std::ptrdiff_t k = 0; k < y.rank_1(y.size()); k += 509) {
+      assert(x.select_1(k) == y.select_1(k));
+    }
+    for (std::ptrdiff_t k = 0; k < y.rank_0(y.size()); k += 509) {
+      assert(x.select_0(k) == y.select_0(k));
+    }
+    assert(eco::succ_1(y, 70001) == 70001);
+    assert(eco::succ_0(y, 70001) == 70600);
+    assert(eco::pred_0(y, 70300) <= 70000);
+  }
+
+  {
+    // Bits on both sides of the superblock boundaries at 65536 and 131072.
+    std::vector<char> bits(2 * 65536 + 1);
+    for (std::ptrdiff_t i = 65536 - 1000; i != 65536 + 1000; ++i) {
+      bits[i] = i % 3 != 0;
+    }
+    bits[131071] = 1;
+    bits[131072] = 1;
+    auto x = make_bitvector<eco::basic_bitvector<>>(bits);
+    x.init();
+    check_bitvector(x, bits);
+    assert(x.rank_1(65536) == 666);
+    assert(x.select_1(x.rank_1(131072)) == 131072);
+  }
+
+  {
+    eco::basic_bitvector<unsigned long> x{100000};
+    x.bit_set(3);
+    x.bit_set(99999);
+    x.init();
+    assert(x.select_1(0) == 3);
+    assert(x.select_1(1) == 99999);
+    assert(x.select_1(2) == 100000);
+    assert(x.select_0(3) == 4);
+    assert(x.select_0(99997) == 99998);
+    assert(x.select_0(99998) == 100000);
+  }
+
+  {
+    eco::basic_bitvector x{0};
+    x.init();
+    assert(x.rank_1(0) == 0);
+    assert(x.select_0(0) == 0);
+    assert(x.select_1(0) == 0);
+  }
+
+  {
+    std::vector<unsigned int> source{0xffff'ffffu, 0x8000'0001u, 0xffff'ffffu};
+    eco::basic_bitvector<> x{source, 70};
+    assert(x.size() == 70);
+    assert(x.rank_1(64) == 34);
+    assert(x.rank_1(70) == 40);
+    assert(x.bit_read(63));
+    assert(x.select_1(32) == 32);
+    assert(x.select_0(0) == 33);
+
+    eco::basic_bitvector<> y{70, std::vector{69, 0, 31, 32, 33, 63, 64, 65, 66, 67, 68}};
+    eco::basic_bitvector<> z{70};
+    for (auto i : {0, 31, 32, 33, 63, 64, 65, 66, 67, 68, 69}) {
+      z.bit_set(i);
+    }
+    z.init();
+    assert(y == z);
+    assert(y.rank_1(64) == 5);
+    assert(y.select_1(4) == 63);
+
+    std::vector<bool> bools(70);
+    for (auto i : {0, 31, 32, 33, 63, 64, 65, 66, 67, 68, 69}) {
+      bools[i] = true;
+    }
+    eco::basic_bitvector<> p{bools};
+    assert(p == z);
+    assert(p.select_0(1) == 2);
+    eco::basic_bitvector<unsigned long> q{bools.begin(), bools.end()};
+    assert(q.size() == 70);
+    assert(q.rank_1(70) == 11);
+    assert(q.select_1(10) == 69);
+  }
+
+  {
+    eco::basic_bitvector<> x{200, std::vector{3, 31, 32, 100, 199}};
+    std::vector<int> ones;
+    for (auto i : x.ones()) {
+      ones.push_back(i);
+    }
+    assert((ones == std::vector{3, 31, 32, 100, 199}));
+    assert(std::ranges::distance(x.zeros()) == 195);
+    assert(*x.zeros().begin() == 0);
+    assert(*std::ranges::next(x.zeros().begin(), 3) == 4);
+
+    assert(x.next_one(0) == 3);
+    assert(x.next_one(4) == 31);
+    assert(x.next_one(33) == 100);
+    assert(x.next_one(199) == 199);
+    assert(x.next_one(200) == 200);
+    assert(x.next_zero(31) == 33);
+    assert(x.prev_one(2) == -1);
+    assert(x.prev_one(99) == 32);
+    assert(x.prev_one(198) == 100);
+    assert(x.prev_zero(32) == 30);
+    assert(x.prev_zero(199) == 198);
+
+    eco::basic_bitvector<> y{70, std::views::iota(0, 70)};
+    assert(std::ranges::distance(y.ones()) == 70);
+    assert(std::ranges::empty(y.zeros()));
+    assert(y.next_zero(0) == 70);
+    assert(y.prev_zero(69) == -1);
+    assert(std::ranges::empty(eco::basic_bitvector<>{}.ones()));
+  }
+
+  {
+    eco::basic_bitvector<> x{100, std::vector{0, 1, 40, 70, 99}};
+    eco::basic_bitvector<> y{100, std::vector{1, 2, 40, 71, 99}};
+
+    assert((x & y) == (eco::basic_bitvector<>{100, std::vector{1, 40, 99}}));
+    assert((x | y) == (eco::basic_bitvector<>{100, std::vector{0, 1, 2, 40, 70, 71, 99}}));
+    assert((x ^ y) == (eco::basic_bitvector<>{100, std::vector{0, 2, 70, 71}}));
+    assert((x - y) == (eco::basic_bitvector<>{100, std::vector{0, 70}}));
+    assert(and_count(x, y) == 3);
+    assert(or_count(x, y) == 7);
+    assert(xor_count(x, y) == 4);
+    assert(and_not_count(x, y) == 2);
+
+    auto z{~x};
+    z.init();
+    assert(z.rank_1(100) == 95);
+    assert(z.select_1(94) == 98);
+    assert(std::ranges::distance(z.zeros()) == 5);
+
+    z |= x;
+    z.init();
+    assert(z.rank_1(100) == 100);
+    z -= y;
+    z ^= x;
+    z &= x;
+    assert(z == (x & y));
+  }
+
+  {
+    // Several superblocks, indexed from one and from several threads.
+    std::vector<std::ptrdiff_t> positions;
+    for (std::ptrdiff_t i = 0; i < 300000; i += 1 + i % 7) {
+      positions.push_back(i);
+    }
+    eco::basic_bitvector x{300000, positions};
+    auto y = x;
+    y.init(4);
+    for (std::ptrdiff_t i = 0; i <= 300000; i += 997) {
+      assert(y.rank_1(i) == x.rank_1(i));
+    }
+    for (std::ptrdiff_t i = 0; i < std::ssize(positions); i += 101) {
+      assert(y.select_1(i) == positions[i]);
+      assert(y.select_0(i) == x.select_0(i));
+    }
+
+    using ssize_type = decltype(x)::ssize_type;
+    std::vector<ssize_type> queries;
+    for (std::ptrdiff_t i = 0; i <= 300000; i += 631) {
+      queries.push_back(static_cast<ssize_type>(i * 7919 % 300001));
+    }
+    std::vector<ssize_type> ranks(queries.size());
+    x.rank_1(queries, ranks);
+    for (std::size_t k = 0; k != queries.size(); ++k) {
+      assert(ranks[k] == x.rank_1(queries[k]));
+    }
+    x.rank_0(queries, ranks);
+    for (std::size_t k = 0; k != queries.size(); ++k) {
+      assert(ranks[k] == x.rank_0(queries[k]));
+    }
+    auto selects = queries;
+    x.select_1(selects, selects);
+    for (std::size_t k = 0; k != queries.size(); ++k) {
+      assert(selects[k] == x.select_1(queries[k]));
+    }
+    selects = queries;
+    x.select_0(selects, selects);
+    for (std::size_t k = 0; k != queries.size(); ++k) {
+      assert(selects[k] == x.select_0(queries[k]));
+    }
+
+    // The same bits appended a bit or a word at a time, queried as they grow.
+    auto const bits = [&](std::ptrdiff_t i, std::ptrdiff_t n) {
+      unsigned int ret{};
+      for (std::ptrdiff_t k = 0; k != n; ++k) {
+        ret |= static_cast<unsigned int>(x.bit_read(static_cast<ssize_type>(i + k))) << k;
+      }
+      return ret;
+    };
+    decltype(x) z;
+    std::ptrdiff_t ones = 0;
+    while (z.size() < 300000) {
+      auto const i = static_cast<std::ptrdiff_t>(z.size());
+      auto const n = std::min<std::ptrdiff_t>(i % 5 == 0 ? 1 : 1 + i % 32, 300000 - i);
+      if (n == 1) z.push_back(x.bit_read(static_cast<ssize_type>(i))); else z.bits_append(static_cast<std::uint8_t>(n), bits(i, n));
+      ones += std::popcount(bits(i, n));
+      if (i % 4099 < 32) {
+        assert(z.rank_1(z.size()) == ones);
+        assert(z.select_1(ones - 1) == positions[ones - 1]);
+        assert(z.select_1(ones) == z.size());
+        assert(z.select_0(z.size() - ones) == z.size());
+      }
+    }
+    assert(z == x);
+    for (std::ptrdiff_t i = 0; i < std::ssize(positions); i += 101) {
+      assert(z.select_1(i) == positions[i]);
+      assert(z.select_0(i) == x.select_0(i));
+    }
+    y.bits_append(32, 0xffff0000u);
+    assert(y.rank_1(y.size()) == x.rank_1(300000) + 16);
+    assert(y.select_0(y.size() - y.rank_1(y.size()) - 1) == 300015);
+  }
+
+  {
+    // Modifying an initialized bitvector drops its directory, so queries
+    // scan until init is called again.
+    eco::basic_bitvector x{200000};
+    for (std::ptrdiff_t i = 0; i < 200000; i += 3) {
+      x.bit_set(i);
+    }
+    x.init();
+    assert(x.rank_1(200000) == 66667);
+    x.bit_clear(0);
+    x.bit_set(199999);
+    x.bit_set(131074);
+    assert(x.rank_1(1) == 0);
+    assert(x.rank_1(131074) == 43691);
+    assert(x.rank_1(131075) == 43692);
+    assert(x.rank_1(200000) == 66668);
+    assert(x.select_1(0) == 3);
+    assert(x.select_1(66667) == 199999);
+    assert(x.select_0(0) == 0);
+    auto y = x;
+    y.init();
+    for (std::ptrdiff_t i = 0; i <= 200000; i += 1009) {
+      assert(y.rank_1(i) == x.rank_1(i));
+    }
+    assert(y.select_1(66667) == 199999);
+    y.bits_write(64, 3, 0);
+    assert(y.rank_1(200000) == 66667);
+    y.flip();
+    assert(y.rank_0(200000) == 66667);
+    y.init();
+    y &= x;
+    assert(y.rank_1(200000) == 1);
+    assert(y.select_1(0) == 66);
+  }
+}
+
+inline void
+test_interleaved_bitvector()
+{
+  {
+    eco::interleaved_bitvector x;
+    assert(x.size() == 0);
+    assert(x.rank_1(0) == 0);
+    assert(x.select_1(0) == 0);
+  }
+
+  {
+    eco::interleaved_bitvector x{55};
+    assert(x.size() == 55);
+    x.bit_set(1);
+    x.bit_set(3);
+    x.bit_set(54);
+    assert(x.bit_read(1));
+    assert(!x.bit_read(2));
+    x.bit_clear(54);
+    assert(!x.bit_read(54));
+
+    assert(x.rank_1(0) == 0);
+    assert(x.rank_1(2) == 1);
+    assert(x.rank_1(4) == 2);
+    assert(x.rank_0(4) == 2);
+    assert(x.select_0(1) == 2);
+    assert(x.select_1(1) == 3);
+    assert(x.select_1(2) == 55);
+
+    auto y{x};
+    y.init();
+    assert(x == y);
+    y.bit_set(0);
+    assert(x < y);
+
+    // Bitvectors of different sizes differ even when their words are equal.
+    eco::interleaved_bitvector z{56};
+    z.bit_set(1);
+    z.bit_set(3);
+    assert(x != z);
+    assert(x < z);
+    assert(y < z);
+  }
+
+  {
+    auto const bits = fixture_bits(140000, 13, 4);
+    auto x = make_bitvector<eco::interleaved_bitvector<>>(bits);
+    x.init();
+    check_bitvector(x, bits);
+  }
+
+  {
+    // Bits on both sides of the line boundaries and of the superblock
+    // boundary after 128 lines of 496 bits.
+    std::vector<char> bits(128 * 496 + 1000);
+    for (std::ptrdiff_t i = 0; i != std::ssize(bits); ++i) {
+      bits[i] = i % 496 < 2 || i % 496 > 493 || (128 * 496 - 300 < i && i < 128 * 496 + 300);
+    }
+    auto x = make_bitvector<eco::interleaved_bitvector<>>(bits);
+    x.init();
+    check_bitvector(x, bits);
+
+    // Modifying an initialized bitvector drops its index, so queries scan
+    // until init is called again.
+    x.bit_clear(0);
+    x.bit_set(300);
+    x.bit_set(128 * 496 + 700);
+    bits[0] = 0;
+    bits[300] = 1;
+    bits[128 * 496 + 700] = 1;
+    check_bitvector(x, bits);
+    x.init();
+    check_bitvector(x, bits);
+
+    eco::interleaved_bitvector y{0};
+    y.init();
+    check_bitvector(y, {});
+  }
+
+  {
+    std::array b{true, true, false, true, true, false, false, false};
+    eco::basic_parentheses<eco::interleaved_bitvector<>> p{b.begin(), b.end()};
+    assert(eco::find_closing(p, 0) == 7);
+    assert(eco::find_closing(p, 3) == 6);
+    assert(eco::find_enclosing(p, 3) == 0);
+  }
 }
 
 #endif
@@ -0,0 +1,203 @@
+#ifndef ECO_TEST_COMPRESSED_BITVECTOR_
+#define ECO_TEST_COMPRESSED_BITVECTOR_
+
+import std;
+import eco;
+
+#include <cassert>
+
+inline void
+test_rrr_bitvector()
+{
+  {
+    eco::rrr_bitvector x;
+    assert(x.size() == 0);
+    x.init();
+    assert(x.rank_1(0) == 0);
+    assert(x.select_0(0) == 0);
+    assert(x.select_1(0) == 0);
+  }
+
+  {
+    eco::rrr_bitvector x{55};
+    assert(x.size() == 55);
+    x.bit_set(1);
+    x.bit_set(3);
+    x.bit_set(54);
+    x.bit_clear(54);
+
+    eco::rrr_bitvector y{x};
+    y.init();
+    assert(x == y);
+    assert(y.bit_read(1));
+    assert(!y.bit_read(2));
+    assert(y.bit_read(3));
+    assert(!y.bit_read(54));
+
+    assert(y.rank_1(0) == 0);
+    assert(y.rank_1(2) == 1);
+    assert(y.rank_1(4) == 2);
+    assert(y.rank_1(55) == 2);
+    assert(y.rank_0(4) == 2);
+    assert(y.select_0(0) == 0);
+    assert(y.select_0(1) == 2);
+    assert(y.select_0(2) == 4);
+    assert(y.select_1(0) == 1);
+    assert(y.select_1(1) == 3);
+    assert(y.select_1(2) == 55);
+
+    eco::rrr_bitvector z{55};
+    z.bit_set(0);
+    z.init();
+    assert(x < z);
+    assert(y < z);
+  }
+
+  {
+    auto const bits = fixture_bits(140000, 97, 3);
+    auto const x = make_bitvector<eco::rrr_bitvector<>>(bits);
+    auto y{x};
+    y.init();
+    assert(x == y);
+    check_bitvector(y, bits);
+  }
+
+  {
+    // Blocks of class 0 and of the full class, aligned to blocks of 63 bits
+    // and straddling them, between mixed blocks.
+    std::vector<char> bits(63 * 300);
+    for (std::ptrdiff_t i = 0; i != std::ssize(bits); ++i) {
+      if (i < 63 * 100) {
+        bits[i] = i >= 63 * 50;
+      } else if (i < 63 * 200) {
+        bits[i] = (i - 31) / (63 * 10) % 2 == 1;
+      } else {
+        bits[i] = i % 5 == 0;
+      }
+    }
+    auto x = make_bitvector<eco::rrr_bitvector<>>(bits);
+    x.init();
+    check_bitvector(x, bits);
+    assert(x.rank_1(63 * 50) == 0);
+    assert(x.rank_1(63 * 100) == 63 * 50);
+
+    eco::rrr_bitvector<> y{63 * 64};
+    for (std::ptrdiff_t i = 0; i != y.size(); ++i) {
+      y.bit_set(i);
+    }
+    y.init();
+    check_bitvector(y, std::vector<char>(63 * 64, 1));
+  }
+
+  {
+    std::array b{true, true, true, false, true, false, false, true, false, false};
+    eco::bp_tree<eco::basic_parentheses<eco::rrr_bitvector<>>> x{b.begin(), b.end()};
+    assert(x.first_child(x.root()) == 1);
+    assert(x.last_child(x.root()) == 7);
+    assert(x.next_sibling(1) == 7);
+    assert(x.parent(4) == 1);
+    assert(x.children(1) == 2);
+    assert(x.is_ancestor(1, 4));
+    assert(!x.is_ancestor(1, 7));
+  }
+}
+
+inline void
+test_elias_fano()
+{
+  {
+    eco::elias_fano x;
+    assert(x.size() == 0);
+    assert(x.rank_1(0) == 0);
+    assert(x.select_1(0) == 0);
+  }
+
+  {
+    eco::elias_fano x{100};
+    assert(x.size() == 100);
+    assert(!x.bit_read(50));
+    assert(x.rank_1(100) == 0);
+    assert(x.select_0(50) == 50);
+    assert(x.select_1(0) == 100);
+  }
+
+  {
+    std::array values{3, 4, 7, 13, 14, 15, 21, 43};
+    eco::elias_fano x{50, values};
+    assert(x.size() == 50);
+
+    assert(x.access(0) == 3);
+    assert(x.access(3) == 13);
+    assert(x.access(7) == 43);
+
+    assert(x.next_geq(0) == 3);
+    assert(x.next_geq(4) == 4);
+    assert(x.next_geq(8) == 13);
+    assert(x.next_geq(22) == 43);
+    assert(x.next_geq(44) == 50);
+
+    assert(x.bit_read(3));
+    assert(!x.bit_read(5));
+    assert(x.rank_1(0) == 0);
+    assert(x.rank_1(4) == 1);
+    assert(x.rank_1(14) == 4);
+    assert(x.rank_1(50) == 8);
+    assert(x.rank_0(14) == 10);
+    assert(x.select_1(5) == 15);
+    assert(x.select_1(8) == 50);
+    assert(x.select_0(0) == 0);
+    assert(x.select_0(3) == 5);
+    assert(x.select_0(10) == 16);
+    assert(x.select_0(42) == 50);
+
+    eco::elias_fano y{50, values};
+    assert(x == y);
+    assert(eco::succ_1(x, 16) == 21);
+    assert(eco::pred_1(x, 20) == 15);
+  }
+
+  {
+    std::array values{0u, 1u, 2u, 5u, 6u, 1000u};
+    eco::elias_fano x{1001, values};
+    assert(x.access(0) == 0);
+    assert(x.access(2) == 2);
+    assert(x.access(5) == 1000);
+    assert(x.next_geq(0) == 0);
+    assert(x.next_geq(3) == 5);
+    assert(x.next_geq(1000) == 1000);
+    assert(x.rank_1(1001) == 6);
+    assert(x.rank_0(1001) == 995);
+    assert(x.select_1(2) == 2);
+    assert(x.select_0(0) == 3);
+    assert(x.select_0(2) == 7);
+    assert(x.bit_read(1000));
+  }
+
+  {
+    eco::basic_bitvector<unsigned long> b{140000};
+    std::vector<std::ptrdiff_t> values;
+    std::ptrdiff_t i{};
+    while (i != b.size()) {
+      if ((i * 7919) % 211 < 2) {
+        b.bit_set(i);
+        values.push_back(i);
+      }
+      ++i;
+    }
+    b.init();
+    eco::elias_fano x{b.size(), values};
+    i = 0;
+    while (i != x.size()) {
+      assert(x.rank_1(i) == b.rank_1(i));
+      assert(x.select_0(i - b.rank_1(i)) == b.select_0(i - b.rank_1(i)));
+      ++i;
+    }
+    i = 0;
+    while (i != std::ssize(values)) {
+      assert(x.select_1(i) == values[i]);
+      ++i;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef ECO_TEST_DYNAMIC_BITVECTOR_
+#define ECO_TEST_DYNAMIC_BITVECTOR_
+
+import std;
+import eco;
+
+#include <cassert>
+
+inline void
+test_dynamic_bitvector()
+{
+  {
+    eco::dynamic_bitvector x;
+    assert(x.size() == 0);
+    assert(x.rank_1(0) == 0);
+    assert(x.select_0(0) == 0);
+    assert(x.select_1(0) == 0);
+  }
+
+  {
+    eco::dynamic_bitvector x{10000};
+    assert(x.size() == 10000);
+    assert(x.rank_0(10000) == 10000);
+    assert(x.select_0(9999) == 9999);
+    assert(x.select_1(0) == 10000);
+    x.bit_set(5000);
+    x.insert(0, true);
+    x.erase(1);
+    assert(x.bit_read(0));
+    assert(x.rank_1(5001) == 2);
+    assert(x.select_1(1) == 5000);
+    x.bit_clear(0);
+    assert(x.select_1(0) == 5000);
+
+    std::vector<std::uint64_t> words(157);
+    words[5000 / 64] = std::uint64_t{1} << (5000 % 64);
+    assert(x == (eco::dynamic_bitvector{words, 10000}));
+    x.push_back(false);
+    assert(x > (eco::dynamic_bitvector{words, 10000}));
+  }
+
+  {
+    // Bits compare in order, and a proper prefix is less.
+    eco::dynamic_bitvector<> x;
+    x.push_back(true);
+    eco::dynamic_bitvector<> y;
+    y.push_back(false);
+    y.push_back(true);
+    eco::dynamic_bitvector<> z;
+    z.push_back(true);
+    z.push_back(false);
+    assert(y < x);
+    assert(x < z);
+    assert(y < z);
+
+    eco::dynamic_bitvector<> a{200};
+    auto b{a};
+    a.bit_set(130);
+    b.bit_set(131);
+    assert(b < a);
+    b.bit_set(130);
+    assert(a < b);
+  }
+
+  {
+    // Compared with a reference while growing past several node splits and
+    // shrinking back through merges.
+    std::vector<std::uint64_t> words;
+    for (std::uint64_t k = 0; k != 500; ++k) {
+      words.push_back(k * 0x9e3779b97f4a7c15u);
+    }
+    eco::dynamic_bitvector<> x{words, 31000};
+    std::vector<char> ref;
+    for (std::ptrdiff_t i = 0; i != 31000; ++i) {
+      ref.push_back(static_cast<char>((words[i / 64] >> (i % 64)) & 1));
+    }
+    auto const check = [&] {
+      assert(x.size() == std::ssize(ref));
+      std::ptrdiff_t ones = 0;
+      for (std::ptrdiff_t i = 0; i != std::ssize(ref); ++i) {
+        if (i % 61 == 0) {
+          assert(x.bit_read(i) == ref[i]);
+          assert(x.rank_1(i) == ones);
+        }
+        if (ref[i]) {
+          if (ones % 37 == 0) assert(x.select_1(ones) == i);
+          ++ones;
+        } else if ((i - ones) % 37 == 0) {
+          assert(x.select_0(i - ones) == i);
+        }
+      }
+      assert(x.rank_1(x.size()) == ones);
+      assert(x.select_1(ones) == x.size());
+    };
+    check();
+
+    std::minstd_rand g{42};
+    for (int k = 0; k != 120000; ++k) {
+      auto const i = static_cast<std::ptrdiff_t>(g() % (ref.size() + 1));
+      auto const bit = g() % 3 == 0;
+      x.insert(i, bit);
+      ref.insert(ref.begin() + i, bit);
+      if (k % 7 == 0) {
+        auto const j = static_cast<std::ptrdiff_t>(g() % ref.size());
+        if (ref[j]) x.bit_clear(j); else x.bit_set(j);
+        ref[j] = !ref[j];
+      }
+      if (k % 40000 == 0) check();
+    }
+    check();
+    auto const y = x;
+    assert(x == y);
+    while (ref.size() > 100) {
+      auto const i = static_cast<std::ptrdiff_t>(g() % ref.size());
+      x.erase(i);
+      ref.erase(ref.begin() + i);
+      if (ref.size() % 30000 == 0) check();
+    }
+    check();
+    assert(y != x);
+    for (std::ptrdiff_t i = 0; i != 100; ++i) {
+      x.erase(0);
+    }
+    assert(x == eco::dynamic_bitvector{});
+  }
+}
+
+#endif
@@ -6,6 +6,145 @@ import eco;
 
 #include <cassert>
 
+// Checks the algorithms that work on any ordinal_tree against the tree's own
+// operations.
+template <eco::ordinal_tree T>
+inline void
+check_tree_algorithms(T const& x)
+{
+  std::vector<std::ptrdiff_t> nodes;
+  std::vector<std::pair<std::ptrdiff_t, bool>> events;
+  eco::visit(x, [&](std::ptrdiff_t v, bool trailing) {
+    if (!trailing) nodes.push_back(v);
+    events.emplace_back(v, trailing);
+  });
+
+  {
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> queries;
+    for (auto u : nodes) {
+      for (auto v : nodes) {
+        queries.emplace_back(u, v);
+      }
+    }
+    auto answers = eco::lca_batch(x, queries);
+    assert(answers.size() == std::ssize(queries));
+    for (std::ptrdiff_t q = 0; q != std::ssize(queries); ++q) {
+      assert(answers[q] == x.lca(queries[q].first, queries[q].second));
+    }
+  }
+
+  {
+    std::vector<std::ptrdiff_t> degrees;
+    std::vector<std::ptrdiff_t> parents;
+    for (std::ptrdiff_t i = 0; i != std::ssize(nodes); ++i) {
+      auto const v = x.node_select(i);
+      degrees.push_back(x.children(v));
+      parents.push_back(v == x.root() ? -1 : x.node_map(x.parent(v)));
+    }
+    std::vector<T> trees;
+    trees.emplace_back(eco::from_degrees, degrees);
+    trees.emplace_back(eco::from_parents, parents);
+    if constexpr (std::constructible_from<T, eco::from_parents_t, decltype(parents)&, int>) {
+      trees.emplace_back(eco::from_parents, parents, 4);
+    }
+    for (auto const& t : trees) {
+      std::vector<std::pair<std::ptrdiff_t, bool>> other;
+      eco::visit(t, [&other](std::ptrdiff_t v, bool trailing) {
+        other.emplace_back(v, trailing);
+      });
+      assert(other == events);
+    }
+  }
+
+  {
+    auto pre = eco::preorder_degrees(x);
+    auto level = eco::level_order_degrees(x);
+    assert(pre.size() == level.size());
+    eco::louds a{x};
+    eco::bp_tree b{x};
+    eco::dfuds c{x};
+    assert(eco::preorder_degrees(a) == pre);
+    assert(eco::preorder_degrees(b) == pre);
+    assert(eco::preorder_degrees(c) == pre);
+    assert(eco::level_order_degrees(a) == level);
+    assert(eco::level_order_degrees(b) == level);
+    assert(eco::level_order_degrees(c) == level);
+    assert(eco::preorder_degrees(eco::louds{b}) == pre);
+    assert(eco::preorder_degrees(eco::bp_tree{c}) == pre);
+    assert(eco::preorder_degrees(eco::dfuds{a}) == pre);
+  }
+
+  {
+    std::vector<std::ptrdiff_t> ones(nodes.size(), 1);
+    auto sizes = eco::tree_fold(x, ones, std::plus<>{});
+    assert(sizes.size() == std::ssize(nodes));
+    assert(sizes[x.node_map(x.root())] == std::ssize(nodes));
+    std::vector<std::ptrdiff_t> ids(nodes.size());
+    std::iota(ids.begin(), ids.end(), 0);
+    auto last = eco::tree_fold(x, ids, [](std::ptrdiff_t a, std::ptrdiff_t b) { return std::max(a, b); });
+    for (auto v : nodes) {
+      std::ptrdiff_t size = 1;
+      std::ptrdiff_t max = x.node_map(v);
+      for (std::ptrdiff_t i = 0; i != x.children(v); ++i) {
+        size += sizes[x.node_map(x.child(v, i))];
+        max = std::max(max, last[x.node_map(x.child(v, i))]);
+      }
+      assert(sizes[x.node_map(v)] == size);
+      assert(last[x.node_map(v)] == max);
+      if constexpr (requires { x.subtree(v); }) {
+        assert(sizes[x.node_map(v)] == x.subtree(v));
+      }
+    }
+  }
+
+  if constexpr (requires (std::ptrdiff_t v) { x.preorder(v); x.subtree(v); }) {
+    std::vector<unsigned long> weights;
+    for (std::size_t k = 0; k != nodes.size(); ++k) {
+      weights.push_back(k * k % 11);
+    }
+    auto sums = eco::tree_fold(x, weights, std::plus<>{});
+    eco::weighted_tree y{x, weights};
+    for (auto v : nodes) {
+      assert(y.weight(v) == weights[x.preorder(v)]);
+      assert(y.subtree_weight(v) == sums[x.preorder(v)]);
+    }
+  }
+
+  {
+    std::vector<std::pair<std::ptrdiff_t, bool>> other;
+    eco::ordinal_tree_cursor c{x};
+    while (true) {
+      other.emplace_back(c.node(), false);
+      assert(c.children() == x.children(c.node()));
+      if (c.has_parent()) {
+        assert(c.child_index() == x.child_rank(c.node()));
+      }
+      if (!c.is_leaf()) {
+        c.to_first_child();
+        continue;
+      }
+      other.emplace_back(c.node(), true);
+      while (c.has_parent() && !c.has_next_sibling()) {
+        c.to_parent();
+        other.emplace_back(c.node(), true);
+      }
+      if (!c.has_parent()) break;
+      c.to_next_sibling();
+    }
+    assert(other == events);
+
+    c.to_last_child();
+    assert(c.node() == x.last_child(x.root()));
+    assert(!c.has_next_sibling());
+    c.to_prev_sibling();
+    assert(c.child_index() == x.children(x.root()) - 2);
+    c.to_parent();
+    c.to_child(1);
+    assert(c.node() == x.child(x.root(), 1));
+    assert(c.depth() == 1);
+  }
+}
+
 inline void
 test_louds()
 {
@@ -275,6 +414,39 @@ test_louds()
   assert(*pos == 13);
   --pos;
   assert(*pos == 6);
+
+  {
+    std::ptrdiff_t n = 0;
+    for (auto v : x.level_order()) {
+      assert(v.index == n);
+      assert(v.node == x.node_select(n));
+      assert(v.children == x.children(v.node));
+      if (v.children != 0) {
+        assert(x.node_map(x.first_child(v.node)) == v.first_child);
+        assert(x.node_map(x.last_child(v.node)) == v.first_child + v.children - 1);
+      }
+      ++n;
+    }
+    assert(n == 20);
+    assert((*x.level_order().begin() == decltype(x)::level_order_node{x.root(), 0, 3, 1}));
+  }
+
+  {
+    std::vector<std::pair<std::ptrdiff_t, std::ptrdiff_t>> queries;
+    eco::visit(x, [&](std::ptrdiff_t v, bool trailing) {
+      if (trailing) return;
+      for (std::ptrdiff_t n = 0; n != x.children(v); ++n) {
+        queries.emplace_back(v, n);
+      }
+    });
+    std::vector<std::ptrdiff_t> out(queries.size());
+    x.child(queries, out);
+    for (std::size_t k = 0; k != queries.size(); ++k) {
+      assert(out[k] == x.child(queries[k].first, queries[k].second));
+    }
+  }
+
+  check_tree_algorithms(x);
 }
 
 inline void
@@ -346,7 +518,7 @@ test_bp_tree()
 
   assert(x.depth(8) == 3);
 
-  assert(x.subtree(8) == 6);
+  assert(x.subtree(8) == 7);
 
   assert(!x.is_ancestor(x.node_select(9), x.node_select(8)));
   assert(x.is_ancestor(x.node_select(8), x.node_select(8)));
@@ -371,9 +543,16 @@ test_bp_tree()
   assert(x.child(7, 0) == 8);
   assert(x.child(7, 1) == 22);
 
-  assert(x.child_rank(22) == 2);
+  assert(x.child_rank(22) == 1);
 
   assert(x.lca(10, 23) == 7);
+  assert(x.lca(23, 10) == 7);
+  assert(x.lca(7, 23) == 7);
+  assert(x.lca(23, 23) == 23);
+  assert(x.lca(2, 37) == x.root());
+  assert(x.is_ancestor(7, 23));
+  assert(!x.is_ancestor(23, 7));
+  assert(!x.is_ancestor(2, 4));
 
   auto pos = x.begin();
   auto end = x.end();
@@ -534,6 +713,61 @@ test_bp_tree()
   assert(*pos == 1);
   --pos;
   assert(*pos == 0);
+
+  {
+    std::vector<std::pair<std::ptrdiff_t, bool>> events;
+    x.visit([&events](std::ptrdiff_t v, bool trailing) {
+      events.emplace_back(v, trailing);
+    });
+    std::vector<std::pair<std::ptrdiff_t, bool>> expected{{x.root(), false}};
+    for (auto i = x.begin(); i != x.end(); ++i) {
+      expected.emplace_back(*i, bool(i));
+    }
+    expected.emplace_back(x.root(), true);
+    assert(events == expected);
+  }
+
+  {
+    // Each node is a child of the previous node or of one of its ancestors,
+    // which builds from several threads.
+    std::vector<std::ptrdiff_t> parents{-1};
+    for (std::ptrdiff_t k = 1; k != 20000; ++k) {
+      auto p = k - 1;
+      for (auto up = k % 3; up != 0 && p != 0; --up) {
+        p = parents[p];
+      }
+      parents.push_back(p);
+    }
+    eco::bp_tree y{eco::from_parents, parents};
+    eco::bp_tree z{eco::from_parents, parents, 4};
+    assert(eco::preorder_degrees(z) == eco::preorder_degrees(y));
+    eco::bp_tree<eco::basic_parentheses<eco::interleaved_bitvector<>>> w{eco::from_parents, parents, 4};
+    assert(eco::preorder_degrees(w) == eco::preorder_degrees(y));
+    std::vector<std::pair<std::ptrdiff_t, bool>> events;
+    eco::visit(y, [&events](std::ptrdiff_t v, bool trailing) {
+      events.emplace_back(v, trailing);
+    });
+    std::vector<std::pair<std::ptrdiff_t, bool>> other;
+    eco::visit(z, [&other](std::ptrdiff_t v, bool trailing) {
+      other.emplace_back(v, trailing);
+    });
+    assert(other == events);
+    std::vector<bool> bits;
+    for (auto [v, trailing] : events) {
+      bits.push_back(!trailing);
+    }
+    eco::bp_tree e{bits, 4};
+    assert(eco::preorder_degrees(e) == eco::preorder_degrees(y));
+    assert(e.lca(19998, 5000) == y.lca(19998, 5000));
+
+    // Sums of the default 32-bit weights over the whole tree exceed 32 bits.
+    std::vector<std::uint32_t> weights(parents.size(), 0xffff'ffffu);
+    eco::weighted_tree t{y, weights};
+    assert(t.subtree_weight(y.root()) == std::uint64_t{0xffff'ffffu} * 20000);
+    assert(t.weight(y.root()) == 0xffff'ffffu);
+  }
+
+  check_tree_algorithms(x);
 }
 
 inline void
@@ -649,9 +883,10 @@ test_dfuds()
   assert(x.child(7, 0) == 10);
   assert(x.child(7, 1) == 11);
 
-  assert(x.child_rank(28) == 2);
+  assert(x.child_rank(28) == 1);
 
   assert(x.lca(20, 30) == 12);
+  assert(x.lca(30, 30) == 30);
 
   auto pos = x.begin();
   auto end = x.end();
@@ -812,6 +1047,49 @@ test_dfuds()
   assert(*pos == 7);
   --pos;
   assert(*pos == 3);
+
+  {
+    std::vector<std::pair<std::ptrdiff_t, bool>> events;
+    x.visit([&events](std::ptrdiff_t v, bool trailing) {
+      events.emplace_back(v, trailing);
+    });
+    std::vector<std::pair<std::ptrdiff_t, bool>> expected{{x.root(), false}};
+    for (auto i = x.begin(); i != x.end(); ++i) {
+      expected.emplace_back(*i, bool(i));
+    }
+    expected.emplace_back(x.root(), true);
+    assert(events == expected);
+  }
+
+  {
+    // Each node is a child of the previous node or of one of its ancestors,
+    // which builds from several threads.
+    std::vector<std::ptrdiff_t> parents{-1};
+    for (std::ptrdiff_t k = 1; k != 20000; ++k) {
+      auto p = k - 1;
+      for (auto up = k % 3; up != 0 && p != 0; --up) {
+        p = parents[p];
+      }
+      parents.push_back(p);
+    }
+    eco::dfuds y{eco::from_parents, parents};
+    eco::dfuds z{eco::from_parents, parents, 4};
+    assert(eco::preorder_degrees(z) == eco::preorder_degrees(y));
+    eco::dfuds<eco::basic_parentheses<eco::interleaved_bitvector<>>> w{eco::from_parents, parents, 4};
+    assert(eco::preorder_degrees(w) == eco::preorder_degrees(y));
+    std::vector<std::pair<std::ptrdiff_t, bool>> events;
+    eco::visit(y, [&events](std::ptrdiff_t v, bool trailing) {
+      events.emplace_back(v, trailing);
+    });
+    std::vector<std::pair<std::ptrdiff_t, bool>> other;
+    eco::visit(z, [&other](std::ptrdiff_t v, bool trailing) {
+      other.emplace_back(v, trailing);
+    });
+    assert(other == events);
+    assert(z.lca(19998, 5000) == y.lca(19998, 5000));
+  }
+
+  check_tree_algorithms(x);
 }
 
 #endif
@@ -52,6 +52,89 @@ test_basic_parentheses()
   assert(p.segment_min_select(7, 35, 0) + 1 == 8);
   assert(p.segment_min_select(7, 35, 1) + 1 == 22);
   assert(p.segment_min_select(7, 35, 2) == 35);
+
+  {
+    // A path of 3000 nodes followed by 1000 leaves spans several blocks.
+    std::vector<bool> v;
+    v.insert(v.end(), 3000, true);
+    v.insert(v.end(), 3000, false);
+    for (int i = 0; i != 1000; ++i) {
+      v.push_back(true);
+      v.push_back(false);
+    }
+    v.insert(v.begin(), true);
+    v.push_back(false);
+
+    eco::basic_parentheses q{v.begin(), v.end()};
+
+    assert(eco::find_closing(q, 0) == 8001);
+    assert(eco::find_closing(q, 1) == 6000);
+    assert(eco::find_closing(q, 1500) == 4501);
+    assert(eco::find_opening(q, 4501) == 1500);
+    assert(eco::find_opening(q, 8001) == 0);
+    assert(eco::find_enclosing(q, 3000) == 2999);
+    assert(eco::find_enclosing(q, 7999) == 0);
+    assert(eco::find_excess(q, 6000, 5) == 8002);
+    assert(eco::find_excess_backward(q, 7000, 2) == 5998);
+    assert(eco::find_excess_backward(q, 6000, -1) == -1);
+
+    assert(q.segment_min(1, 7000) == 6000);
+    assert(q.segment_max(0, 7000) == 3000);
+    assert(q.segment_min_count(1, 7000) == 500);
+    assert(q.segment_min_select(1, 7000, 1) == 6002);
+    assert(q.segment_min_select(1, 7000, 499) == 6998);
+    assert(q.segment_min_select(1, 7000, 500) == 7000);
+
+    eco::basic_parentheses r{v.begin(), v.end()};
+    r.init(4);
+    assert(r.segment_min(1, 7000) == 6000);
+    assert(r.segment_min_count(1, 7000) == 500);
+    assert(eco::find_excess(r, 6000, 5) == 8002);
+  }
+
+  {
+    // A walk drifting up and down over several superblocks of the sparse
+    // table, checked against a scan of the excess.
+    std::vector<bool> v;
+    std::vector<std::ptrdiff_t> excess;
+    std::ptrdiff_t e = 0;
+    for (std::ptrdiff_t i = 0; i != 300000; ++i) {
+      auto const up = (i / 40000) % 2 == 0 ? 55 : 45;
+      auto const open = e == 0 || static_cast<std::ptrdiff_t>((i * 2654435761) >> 7) % 100 < up;
+      v.push_back(open);
+      e += open ? 1 : -1;
+      excess.push_back(e);
+    }
+    while (e != 0) {
+      v.push_back(false);
+      excess.push_back(--e);
+    }
+    eco::basic_parentheses p{v.begin(), v.end()};
+    for (std::ptrdiff_t i = 1; i < 300000; i += 23456) {
+      for (std::ptrdiff_t j = i; j < std::ssize(v); j += 31337) {
+        auto const min = std::min_element(excess.begin() + i, excess.begin() + j) - excess.begin();
+        assert(p.segment_min(i, j) == min);
+      }
+    }
+  }
+
+  {
+    // Excess past the range of the 16-bit fields of the lower tree nodes.
+    std::vector<bool> v(50000, true);
+    for (std::ptrdiff_t i = 0; i != 20000; ++i) {
+      v.push_back(i % 3 == 0);
+    }
+    auto const n = std::ranges::count(v, true) * 2;
+    v.resize(static_cast<std::size_t>(n), false);
+    eco::basic_parentheses p{v.begin(), v.end()};
+    assert(eco::find_closing(p, 0) == n - 1);
+    assert(eco::find_closing(p, 100) == n - 101);
+    assert(eco::find_opening(p, n - 1) == 0);
+    assert(eco::find_enclosing(p, 49999) == 49998);
+    assert(p.segment_min(1, n - 1) == n - 2);
+    assert(p.segment_max(0, n - 1) == 50000);
+    assert(p.excess(50000) == 50001);
+  }
 }
 
 #endif
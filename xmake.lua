@@ -25,6 +25,8 @@ target("eco")
         "include/eco_array.mpp",
         "include/eco_array_dict.mpp",
         "include/eco_bitvector.mpp",
+        "include/eco_compressed_bitvector.mpp",
+        "include/eco_dynamic_bitvector.mpp",
         "include/eco_forward_list_pool.mpp",
         "include/eco_iterator.mpp",
         "include/eco_list_pool.mpp",
@@ -40,3 +42,8 @@ target("eco")
 target("test")
     add_deps("eco")
     add_files("test/unit/main.cpp")
+
+target("bench")
+    set_default(false)
+    add_deps("eco")
+    add_files("bench/main.cpp")